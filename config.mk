@@ -30,6 +30,12 @@ AMCL_BUILD_MPIN:=ON
 # Build WCC ON/OFF
 AMCL_BUILD_WCC:=ON
 
+# Build BLS ON/OFF
+AMCL_BUILD_BLS:=ON
+
+# Multi-threaded pairings using pthreads ON/OFF
+AMCL_USE_PTHREADS:=OFF
+
 # Build Doxygen ON/OFF
 AMCL_BUILD_DOCS:=ON
 
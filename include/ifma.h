@@ -0,0 +1,101 @@
+/*
+	Licensed to the Apache Software Foundation (ASF) under one
+	or more contributor license agreements.  See the NOTICE file
+	distributed with this work for additional information
+	regarding copyright ownership.  The ASF licenses this file
+	to you under the Apache License, Version 2.0 (the
+	"License"); you may not use this file except in compliance
+	with the License.  You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing,
+	software distributed under the License is distributed on an
+	"AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+	KIND, either express or implied.  See the License for the
+	specific language governing permissions and limitations
+	under the License.
+*/
+
+/**
+ * @file ifma.h
+ * @brief AVX-512 IFMA Montgomery Multiplication Header File
+ *
+ * Montgomery multiplication of numbers held as 52-bit limbs, eight to
+ * a 512-bit vector, using the 52-bit multiply-accumulate instructions
+ * of AVX-512 IFMA. Used by the FF exponentiations when the CPU supports
+ * them. Only available if the library is built with USE_IFMA.
+ *
+ */
+
+#ifndef IFMA_H
+#define IFMA_H
+
+#include "amcl.h"
+
+#ifdef AMCL_IFMA
+
+#define IFMA_BITS 52                                  /**< Bits in a limb */
+#define IFMA_MASK (((unsign64)1<<IFMA_BITS)-1)        /**< Limb mask */
+#define IFMA_LEN(b) ((((b)+IFMA_BITS-1)/IFMA_BITS+7)&~7) /**< Limbs stored for b bits, a whole number of vectors */
+#define IFMA_MAXLIMBS IFMA_LEN(4096+64)                  /**< Largest IFMA_LEN, for a 4096-bit modulus */
+
+/**
+ * @brief Modulus in 52-bit limbs, with its Montgomery constant. R=2^(52.L)
+ */
+typedef struct
+{
+    int L;                       /**< Number of limbs, at least two more bits than the modulus */
+    unsign64 k0;                 /**< -1/m mod 2^52 */
+    unsign64 m[IFMA_MAXLIMBS];   /**< Modulus, least significant limb first, padded with zeros */
+} ifma_modulus;
+
+/**	@brief Test if the CPU supports AVX-512 IFMA
+ *
+	@return 1 if IFMA_mul can be used, else 0
+ */
+extern int IFMA_available(void);
+/**	@brief Set up a modulus for IFMA_mul
+ *
+	@param M the output modulus
+	@param P the odd modulus in big-endian base 256 form, at most 512 bytes
+	@param b R is also made at least 2^b, so that Montgomery forms for a larger R can be converted by doubling
+ */
+extern void IFMA_mont(ifma_modulus *M,octet *P,int b);
+/**	@brief Convert a number from big-endian base 256 form to limbs
+ *
+	@param x output limbs, padded with zeros
+	@param W input number in big-endian base 256 form
+	@param len number of limbs to output, a multiple of 8
+ */
+extern void IFMA_fromOctet(unsign64 *x,octet *W,int len);
+/**	@brief Convert a number from limbs to big-endian base 256 form
+ *
+	@param W output number, of len bytes
+	@param x input limbs, each less than 2^52
+	@param len number of bytes to output
+ */
+extern void IFMA_toOctet(octet *W,unsign64 *x,int len);
+/**	@brief Montgomery multiplication r=a.b/R mod m
+ *
+	a and b must be less than 2m, and then so is r. r may be the same as a or b.
+	@param r output limbs
+	@param a input limbs
+	@param b input limbs
+	@param M the modulus
+ */
+extern void IFMA_mul(unsign64 *r,unsign64 *a,unsign64 *b,ifma_modulus *M);
+/**	@brief Eight Montgomery multiplications r=a.b/R mod m at once
+ *
+	Limb j of number k is at index 8j+k of each array, and there are M->L limbs. a and b must be less than 2m,
+	and then so is r. r may be the same as a or b.
+	@param r output limbs
+	@param a input limbs
+	@param b input limbs
+	@param M the modulus
+ */
+extern void IFMA_mul8(unsign64 *r,unsign64 *a,unsign64 *b,ifma_modulus *M);
+
+#endif
+
+#endif
@@ -0,0 +1,84 @@
+/*
+	Licensed to the Apache Software Foundation (ASF) under one
+	or more contributor license agreements.  See the NOTICE file
+	distributed with this work for additional information
+	regarding copyright ownership.  The ASF licenses this file
+	to you under the Apache License, Version 2.0 (the
+	"License"); you may not use this file except in compliance
+	with the License.  You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing,
+	software distributed under the License is distributed on an
+	"AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+	KIND, either express or implied.  See the License for the
+	specific language governing permissions and limitations
+	under the License.
+*/
+
+/**
+ * @file pool.h
+ * @brief Thread Pool Header File
+ *
+ * A fixed set of worker threads, created once by the caller and
+ * reused by the multi-threaded pairing functions. Only available
+ * if the library is built with USE_PTHREADS.
+ *
+ */
+
+#ifndef POOL_H
+#define POOL_H
+
+#include "amcl.h"
+
+#ifdef AMCL_THREADS
+
+#include <pthread.h>
+
+#define POOL_MAX_THREADS 16  /**< Maximum number of worker threads in a pool */
+
+/**
+ * @brief Thread pool instance */
+typedef struct
+{
+    pthread_t thread[POOL_MAX_THREADS]; /**< Worker threads */
+    int nthreads;                       /**< Number of worker threads */
+    pthread_mutex_t lock;               /**< Protects the job state below */
+    pthread_cond_t work;                /**< Signalled when a job is posted or the pool is killed */
+    pthread_cond_t done;                /**< Signalled when a job completes */
+    void (*task)(void *,int);           /**< Task function of the current job */
+    void *arg;                          /**< Task argument of the current job */
+    int ntasks;                         /**< Number of tasks in the current job */
+    int next;                           /**< Next task to be started */
+    int pending;                        /**< Number of tasks not yet completed */
+    int busy;                           /**< Set while a job is running */
+    int shutdown;                       /**< Set when the pool is killed */
+} amcl_pool;
+
+/**	@brief Create a thread pool
+ *
+	@param P the thread pool
+	@param n the number of worker threads, at most POOL_MAX_THREADS. The calling thread also runs tasks.
+	@return 0 if successful, else -1
+ */
+extern int POOL_init(amcl_pool *P,int n);
+/**	@brief Run n tasks on the pool and wait for them to complete
+ *
+	Calls task(arg,i) for i=0..n-1, distributed over the worker threads and the calling thread.
+	Jobs submitted by different threads to the same pool are run one after the other.
+	@param P the thread pool
+	@param n the number of tasks
+	@param task the task function
+	@param arg the argument passed to every task
+ */
+extern void POOL_run(amcl_pool *P,int n,void (*task)(void *arg,int i),void *arg);
+/**	@brief Stop and join the worker threads of a pool
+ *
+	@param P the thread pool
+ */
+extern void POOL_kill(amcl_pool *P);
+
+#endif
+
+#endif
@@ -31,6 +31,15 @@
 
 #define MAX_RSA_BYTES 512 /**< Maximum of 4096 */
 
+/**
+ * @brief Message hash for RSA-PSS, built up a chunk at a time */
+typedef struct
+{
+    int sha;            /**< Hash type */
+    hash256 sh256;      /**< SHA256 instance */
+    hash512 sh512;      /**< SHA384 or SHA512 instance */
+} pss_context;
+
 /**	@brief PKCS V1.5 padding of a message prior to RSA signature
  *
 	@param h is the hash type
@@ -58,5 +67,37 @@ extern int	OAEP_ENCODE(int h,octet *M,csprng *R,octet *P,octet *F);
 	@return 0 if OK, else 1
  */
 extern int  OAEP_DECODE(int h,octet *P,octet *F);
+/**	@brief Start hashing a message for RSA-PSS
+ *
+	@param C is the context to initialise
+	@param h is the hash type
+	@return 0 if OK, else 1
+ */
+extern int PSS_INIT(pss_context *C,int h);
+/**	@brief Add the next chunk of the message to the RSA-PSS hash
+ *
+	The message can be passed in any number of chunks of any length
+	@param C is the context
+	@param M is the next chunk of the message
+ */
+extern void PSS_UPDATE(pss_context *C,octet *M);
+/**	@brief PSS encoding of the hashed message prior to RSA signature
+ *
+	The salt is the length of the hash. The modulus must be 8*F->max bits, as from RSA_KEY_PAIR.
+	The context is reset for another message.
+	@param C is the context holding the hashed message
+	@param R is a pointer to a cryptographically secure random number generator
+	@param F is the output encoding, ready for RSA signature
+	@return 0 if OK, else 1
+ */
+extern int PSS_ENCODE(pss_context *C,csprng *R,octet *F);
+/**	@brief Check a PSS encoding of the hashed message, recovered by RSA verification
+ *
+	The context is reset for another message.
+	@param C is the context holding the hashed message
+	@param F is the encoding, as output by RSA_ENCRYPT of the signature
+	@return 0 if the encoding matches the message, else 1
+ */
+extern int PSS_VERIFY(pss_context *C,octet *F);
 
 #endif
@@ -154,6 +154,34 @@ void HASH256_process(hash256 *sh,int byt)
     if ((sh->length[0]%512)==0) HASH256_transform(sh);
 }
 
+/* process len bytes, whole 64-byte blocks are loaded straight into the message schedule */
+void HASH256_process_array(hash256 *sh,const char *b,int len)
+{
+    int j;
+    while (len>0 && (sh->length[0]%512)!=0)
+    {
+        HASH256_process(sh,*b++);
+        len--;
+    }
+    while (len>=64)
+    {
+        for (j=0; j<16; j++)
+        {
+            sh->w[j]=((unsign32)(unsigned char)b[0]<<24)|((unsign32)(unsigned char)b[1]<<16)|((unsign32)(unsigned char)b[2]<<8)|(unsign32)(unsigned char)b[3];
+            b+=4;
+        }
+        sh->length[0]+=512;
+        if (sh->length[0]==0L) sh->length[1]++;
+        HASH256_transform(sh);
+        len-=64;
+    }
+    while (len>0)
+    {
+        HASH256_process(sh,*b++);
+        len--;
+    }
+}
+
 /* SU= 24 */
 /* Generate 32-byte Hash */
 void HASH256_hash(hash256 *sh,char *digest)
@@ -288,6 +316,11 @@ void HASH384_process(hash384 *sh,int byt)
     HASH512_process(sh,byt);
 }
 
+void HASH384_process_array(hash384 *sh,const char *b,int len)
+{
+    HASH512_process_array(sh,b,len);
+}
+
 void HASH384_hash(hash384 *sh,char *hash)
 {
     /* pad message and finish - supply digest */
@@ -332,6 +365,35 @@ void HASH512_process(hash512 *sh,int byt)
     if ((sh->length[0]%1024)==0) HASH512_transform(sh);
 }
 
+/* process len bytes, whole 128-byte blocks are loaded straight into the message schedule */
+void HASH512_process_array(hash512 *sh,const char *b,int len)
+{
+    int i,j;
+    while (len>0 && (sh->length[0]%1024)!=0)
+    {
+        HASH512_process(sh,*b++);
+        len--;
+    }
+    while (len>=128)
+    {
+        for (j=0; j<16; j++)
+        {
+            sh->w[j]=0;
+            for (i=0; i<8; i++) sh->w[j]=(sh->w[j]<<8)|(unsign64)(unsigned char)b[i];
+            b+=8;
+        }
+        sh->length[0]+=1024;
+        if (sh->length[0]==0L) sh->length[1]++;
+        HASH512_transform(sh);
+        len-=128;
+    }
+    while (len>0)
+    {
+        HASH512_process(sh,*b++);
+        len--;
+    }
+}
+
 void HASH512_hash(hash512 *sh,char *hash)
 {
     /* pad message and finish - supply digest */
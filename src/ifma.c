@@ -0,0 +1,236 @@
+/*
+	Licensed to the Apache Software Foundation (ASF) under one
+	or more contributor license agreements.  See the NOTICE file
+	distributed with this work for additional information
+	regarding copyright ownership.  The ASF licenses this file
+	to you under the Apache License, Version 2.0 (the
+	"License"); you may not use this file except in compliance
+	with the License.  You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing,
+	software distributed under the License is distributed on an
+	"AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+	KIND, either express or implied.  See the License for the
+	specific language governing permissions and limitations
+	under the License.
+*/
+
+/* AVX-512 IFMA Montgomery multiplication for FF exponentiation */
+
+#include "ifma.h"
+
+#ifdef AMCL_IFMA
+
+#include <immintrin.h>
+
+#define IFMA_MAXVEC (IFMA_MAXLIMBS/8)
+
+int IFMA_available(void)
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+}
+
+void IFMA_fromOctet(unsign64 *x,octet *W,int len)
+{
+    int i,j=0,b=0;
+    unsign64 t=0;
+
+    for (i=W->len-1; i>=0; i--)
+    {
+        t|=(unsign64)(unsigned char)W->val[i]<<b;
+        b+=8;
+        if (b>=IFMA_BITS)
+        {
+            x[j++]=t&IFMA_MASK;
+            t>>=IFMA_BITS;
+            b-=IFMA_BITS;
+        }
+    }
+    while (j<len)
+    {
+        x[j++]=t;
+        t=0;
+    }
+}
+
+void IFMA_toOctet(octet *W,unsign64 *x,int len)
+{
+    int i,j=0,b=0;
+    unsign64 t=0;
+
+    for (i=len-1; i>=0; i--)
+    {
+        if (b<8)
+        {
+            t|=x[j++]<<b;
+            b+=IFMA_BITS;
+        }
+        W->val[i]=(char)(t&0xff);
+        t>>=8;
+        b-=8;
+    }
+    W->len=len;
+}
+
+void IFMA_mont(ifma_modulus *M,octet *P,int b)
+{
+    int i;
+    unsign64 inv;
+
+    /* R>4m so that outputs less than 2m can be inputs again */
+    if (b<8*P->len+2) b=8*P->len+2;
+    M->L=(b+IFMA_BITS-1)/IFMA_BITS;
+    IFMA_fromOctet(M->m,P,IFMA_MAXLIMBS);
+
+    /* Newton iteration for 1/m mod 2^64, starting from 3 correct bits */
+    inv=M->m[0];
+    for (i=0; i<5; i++) inv*=2-M->m[0]*inv;
+    M->k0=(0-inv)&IFMA_MASK;
+}
+
+/* Word-by-word Montgomery multiplication with V vectors of limbs. The accumulator is held unnormalised in
+   64-bit lanes, and is shifted down one limb per step, with the low 52 bits of each product added before the
+   shift and the high 52 bits after it. Inlined for each V so that the vectors stay in registers */
+__attribute__((target("avx512f,avx512ifma"),always_inline))
+static inline void ifma_mul(unsign64 *r,unsign64 *a,unsign64 *b,ifma_modulus *M,const int V)
+{
+    int i,j;
+    unsign64 t,y,acc[IFMA_MAXLIMBS];
+    __m512i A[IFMA_MAXVEC],X[IFMA_MAXVEC],P[IFMA_MAXVEC],bi,yi;
+    const __m512i zero=_mm512_setzero_si512();
+
+    for (j=0; j<V; j++)
+    {
+        A[j]=zero;
+        X[j]=_mm512_loadu_si512((const void *)&a[8*j]);
+        P[j]=_mm512_loadu_si512((const void *)&M->m[8*j]);
+    }
+
+    for (i=0; i<M->L; i++)
+    {
+        bi=_mm512_set1_epi64((long long)b[i]);
+        for (j=0; j<V; j++)
+            A[j]=_mm512_madd52lo_epu64(A[j],X[j],bi);
+
+        t=(unsign64)_mm_cvtsi128_si64(_mm512_castsi512_si128(A[0]));
+        y=(t*M->k0)&IFMA_MASK;
+        yi=_mm512_set1_epi64((long long)y);
+        for (j=0; j<V; j++)
+            A[j]=_mm512_madd52lo_epu64(A[j],P[j],yi);
+
+        /* low limb is now zero mod 2^52, shift down and carry its top bits */
+        t=(t+((M->m[0]*y)&IFMA_MASK))>>IFMA_BITS;
+        for (j=0; j<V-1; j++)
+            A[j]=_mm512_alignr_epi64(A[j+1],A[j],1);
+        A[V-1]=_mm512_alignr_epi64(zero,A[V-1],1);
+        A[0]=_mm512_mask_add_epi64(A[0],1,A[0],_mm512_set1_epi64((long long)t));
+
+        for (j=0; j<V; j++)
+        {
+            A[j]=_mm512_madd52hi_epu64(A[j],X[j],bi);
+            A[j]=_mm512_madd52hi_epu64(A[j],P[j],yi);
+        }
+    }
+
+    for (j=0; j<V; j++)
+        _mm512_storeu_si512((void *)&acc[8*j],A[j]);
+    t=0;
+    for (j=0; j<8*V; j++)
+    {
+        t+=acc[j];
+        r[j]=t&IFMA_MASK;
+        t>>=IFMA_BITS;
+    }
+}
+
+__attribute__((target("avx512f,avx512ifma")))
+void IFMA_mul(unsign64 *r,unsign64 *a,unsign64 *b,ifma_modulus *M)
+{
+    switch ((M->L+7)/8)
+    {
+    case 1:
+        ifma_mul(r,a,b,M,1);
+        break;
+    case 2:
+        ifma_mul(r,a,b,M,2);
+        break;
+    case 3:
+        ifma_mul(r,a,b,M,3);
+        break;
+    case 4:
+        ifma_mul(r,a,b,M,4);
+        break;
+    case 5:
+        ifma_mul(r,a,b,M,5);
+        break;
+    case 6:
+        ifma_mul(r,a,b,M,6);
+        break;
+    case 7:
+        ifma_mul(r,a,b,M,7);
+        break;
+    case 8:
+        ifma_mul(r,a,b,M,8);
+        break;
+    case 9:
+        ifma_mul(r,a,b,M,9);
+        break;
+    default:
+        ifma_mul(r,a,b,M,10);
+        break;
+    }
+}
+
+/* Eight independent Montgomery multiplications, one per 64-bit lane, so that limb j of every lane is in one
+   vector. The limbs are the same as in ifma_mul, but the accumulator is a window of L vectors that slides up
+   one vector per step, in place of the shift */
+__attribute__((target("avx512f,avx512ifma")))
+void IFMA_mul8(unsign64 *r,unsign64 *a,unsign64 *b,ifma_modulus *M)
+{
+    int i,j,L=M->L;
+    __m512i A[2*IFMA_MAXLIMBS],X[IFMA_MAXLIMBS],bi,yi,mj,t;
+    const __m512i zero=_mm512_setzero_si512();
+    const __m512i mask=_mm512_set1_epi64((long long)IFMA_MASK);
+    const __m512i k0=_mm512_set1_epi64((long long)M->k0);
+
+    for (j=0; j<2*L; j++) A[j]=zero;
+    for (j=0; j<L; j++)
+        X[j]=_mm512_loadu_si512((const void *)&a[8*j]);
+
+    for (i=0; i<L; i++)
+    {
+        bi=_mm512_loadu_si512((const void *)&b[8*i]);
+        for (j=0; j<L; j++)
+            A[i+j]=_mm512_madd52lo_epu64(A[i+j],X[j],bi);
+
+        yi=_mm512_madd52lo_epu64(zero,A[i],k0);
+        for (j=0; j<L; j++)
+        {
+            mj=_mm512_set1_epi64((long long)M->m[j]);
+            A[i+j]=_mm512_madd52lo_epu64(A[i+j],mj,yi);
+        }
+
+        /* low limb is now zero mod 2^52, carry its top bits into the next */
+        A[i+1]=_mm512_add_epi64(A[i+1],_mm512_srli_epi64(A[i],IFMA_BITS));
+
+        for (j=0; j<L; j++)
+        {
+            mj=_mm512_set1_epi64((long long)M->m[j]);
+            A[i+j+1]=_mm512_madd52hi_epu64(A[i+j+1],X[j],bi);
+            A[i+j+1]=_mm512_madd52hi_epu64(A[i+j+1],mj,yi);
+        }
+    }
+
+    t=zero;
+    for (j=0; j<L; j++)
+    {
+        t=_mm512_add_epi64(t,A[L+j]);
+        _mm512_storeu_si512((void *)&r[8*j],_mm512_and_si512(t,mask));
+        t=_mm512_srli_epi64(t,IFMA_BITS);
+    }
+}
+
+#endif
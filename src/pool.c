@@ -0,0 +1,128 @@
+/*
+	Licensed to the Apache Software Foundation (ASF) under one
+	or more contributor license agreements.  See the NOTICE file
+	distributed with this work for additional information
+	regarding copyright ownership.  The ASF licenses this file
+	to you under the Apache License, Version 2.0 (the
+	"License"); you may not use this file except in compliance
+	with the License.  You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing,
+	software distributed under the License is distributed on an
+	"AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+	KIND, either express or implied.  See the License for the
+	specific language governing permissions and limitations
+	under the License.
+*/
+
+/* Thread pool for multi-threaded pairings */
+
+#include "pool.h"
+
+#ifdef AMCL_THREADS
+
+/* Run tasks of the current job until none are left. Called with the lock held */
+static void pool_work(amcl_pool *P)
+{
+    int i;
+    while (P->next<P->ntasks)
+    {
+        i=P->next++;
+        pthread_mutex_unlock(&P->lock);
+        P->task(P->arg,i);
+        pthread_mutex_lock(&P->lock);
+        P->pending--;
+        if (P->pending==0) pthread_cond_broadcast(&P->done);
+    }
+}
+
+static void *pool_worker(void *arg)
+{
+    amcl_pool *P=(amcl_pool *)arg;
+
+    pthread_mutex_lock(&P->lock);
+    while (!P->shutdown)
+    {
+        if (P->next<P->ntasks)
+            pool_work(P);
+        else
+            pthread_cond_wait(&P->work,&P->lock);
+    }
+    pthread_mutex_unlock(&P->lock);
+    return NULL;
+}
+
+int POOL_init(amcl_pool *P,int n)
+{
+    int i;
+    if (n<0 || n>POOL_MAX_THREADS) return -1;
+
+    P->nthreads=0;
+    P->task=NULL;
+    P->arg=NULL;
+    P->ntasks=0;
+    P->next=0;
+    P->pending=0;
+    P->busy=0;
+    P->shutdown=0;
+
+    if (pthread_mutex_init(&P->lock,NULL)!=0) return -1;
+    pthread_cond_init(&P->work,NULL);
+    pthread_cond_init(&P->done,NULL);
+
+    for (i=0; i<n; i++)
+    {
+        if (pthread_create(&P->thread[i],NULL,pool_worker,P)!=0)
+        {
+            POOL_kill(P);
+            return -1;
+        }
+        P->nthreads++;
+    }
+    return 0;
+}
+
+void POOL_run(amcl_pool *P,int n,void (*task)(void *,int),void *arg)
+{
+    pthread_mutex_lock(&P->lock);
+    while (P->busy) pthread_cond_wait(&P->done,&P->lock);
+
+    P->busy=1;
+    P->task=task;
+    P->arg=arg;
+    P->ntasks=n;
+    P->next=0;
+    P->pending=n;
+    pthread_cond_broadcast(&P->work);
+
+    /* the calling thread takes its share */
+    pool_work(P);
+    while (P->pending>0) pthread_cond_wait(&P->done,&P->lock);
+
+    P->ntasks=0;
+    P->next=0;
+    P->busy=0;
+    pthread_cond_broadcast(&P->done);
+    pthread_mutex_unlock(&P->lock);
+}
+
+void POOL_kill(amcl_pool *P)
+{
+    int i;
+    pthread_mutex_lock(&P->lock);
+    P->shutdown=1;
+    pthread_cond_broadcast(&P->work);
+    pthread_mutex_unlock(&P->lock);
+
+    for (i=0; i<P->nthreads; i++)
+        pthread_join(P->thread[i],NULL);
+    P->nthreads=0;
+
+    pthread_cond_destroy(&P->work);
+    pthread_cond_destroy(&P->done);
+    pthread_mutex_destroy(&P->lock);
+}
+
+#endif
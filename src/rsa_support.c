@@ -235,3 +235,144 @@ int OAEP_DECODE(int sha,octet *p,octet *f)
 
     return 0;
 }
+
+/* RSA-PSS, streaming message hash */
+
+int PSS_INIT(pss_context *C,int sha)
+{
+    C->sha=sha;
+    switch (sha)
+    {
+    case SHA256:
+        HASH256_init(&C->sh256);
+        break;
+    case SHA384:
+        HASH384_init(&C->sh512);
+        break;
+    case SHA512:
+        HASH512_init(&C->sh512);
+        break;
+    default:
+        return 1;
+    }
+    return 0;
+}
+
+void PSS_UPDATE(pss_context *C,octet *m)
+{
+    switch (C->sha)
+    {
+    case SHA256:
+        HASH256_process_array(&C->sh256,m->val,m->len);
+        break;
+    case SHA384:
+        HASH384_process_array(&C->sh512,m->val,m->len);
+        break;
+    case SHA512:
+        HASH512_process_array(&C->sh512,m->val,m->len);
+        break;
+    }
+}
+
+/* H=hash(0^8|mHash|salt), where mHash is the message hash held in C, which is reset */
+static void PSS_hash(pss_context *C,octet *salt,octet *h)
+{
+    char mp[8+64+64];
+    octet MP= {0,sizeof(mp),mp};
+
+    OCT_jbyte(&MP,0,8);
+    switch (C->sha)
+    {
+    case SHA256:
+        HASH256_hash(&C->sh256,&mp[8]);
+        break;
+    case SHA384:
+        HASH384_hash(&C->sh512,&mp[8]);
+        break;
+    case SHA512:
+        HASH512_hash(&C->sh512,&mp[8]);
+        break;
+    }
+    MP.len+=C->sha;
+    OCT_joctet(&MP,salt);
+    hashit(C->sha,&MP,-1,h);
+    OCT_clear(&MP);
+}
+
+/* PSS Message Encoding for Signature */
+
+int PSS_ENCODE(pss_context *C,csprng *RNG,octet *f)
+{
+    int i,hlen,slen,olen=f->max;
+    char dbmask[MAX_RSA_BYTES],salt[64],h[64];
+    octet DBMASK= {0,sizeof(dbmask),dbmask};
+    octet SALT= {0,sizeof(salt),salt};
+    octet H= {0,sizeof(h),h};
+
+    hlen=slen=C->sha;
+    if (olen>MAX_RSA_BYTES || olen<hlen+slen+2) return 1;
+
+    OCT_rand(&SALT,RNG,slen);
+    PSS_hash(C,&SALT,&H);
+
+    /* DB=0..0|1|salt, masked */
+    OCT_empty(f);
+    OCT_jbyte(f,0,olen-slen-hlen-2);
+    OCT_jbyte(f,0x01,1);
+    OCT_joctet(f,&SALT);
+    MGF1(C->sha,&H,olen-hlen-1,&DBMASK);
+    for (i=0; i<olen-hlen-1; i++) f->val[i]^=DBMASK.val[i];
+    f->val[0]&=0x7f;
+
+    OCT_joctet(f,&H);
+    OCT_jbyte(f,0xbc,1);
+
+    OCT_clear(&SALT);
+    OCT_clear(&DBMASK);
+    return 0;
+}
+
+/* PSS Message Decoding for Verification */
+
+int PSS_VERIFY(pss_context *C,octet *f)
+{
+    int i,k,hlen,slen,dblen,olen=f->len;
+    int bad=0;
+    char db[MAX_RSA_BYTES],h[64],hp[64];
+    octet DB= {0,sizeof(db),db};
+    octet SALT= {0,0,NULL};
+    octet H= {0,sizeof(h),h};
+    octet HP= {0,sizeof(hp),hp};
+
+    hlen=slen=C->sha;
+    dblen=olen-hlen-1;
+    if (olen>MAX_RSA_BYTES || olen<hlen+slen+2) bad=1;
+    else if ((unsigned char)f->val[olen-1]!=0xbc || (f->val[0]&0x80)!=0) bad=1;
+    else
+    {
+        /* unmask DB and check it is 0..0|1|salt */
+        OCT_jbytes(&H,&f->val[dblen],hlen);
+        MGF1(C->sha,&H,dblen,&DB);
+        for (i=0; i<dblen; i++) DB.val[i]^=f->val[i];
+        DB.val[0]&=0x7f;
+        k=dblen-slen-1;
+        for (i=0; i<k; i++)
+            if (DB.val[i]!=0) bad=1;
+        if (DB.val[k]!=0x01) bad=1;
+    }
+
+    if (bad)
+    {
+        PSS_INIT(C,C->sha);
+        OCT_clear(&DB);
+        return 1;
+    }
+
+    SALT.len=SALT.max=slen;
+    SALT.val=&DB.val[dblen-slen];
+    PSS_hash(C,&SALT,&HP);
+    bad=!OCT_comp(&H,&HP);
+
+    OCT_clear(&DB);
+    return bad;
+}
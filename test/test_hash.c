@@ -164,6 +164,34 @@ int main(int argc, char** argv)
                 printf("TEST HASH FAILED COMPARE MD LINE %d\n",lineNo);
                 exit(EXIT_FAILURE);
             }
+
+            // Same again, in two arrays split unevenly
+            if (!strcmp(argv[2], "sha512"))
+            {
+                HASH512_process_array(&sha512,Msg,MsgLen/3);
+                HASH512_process_array(&sha512,Msg+MsgLen/3,MsgLen-MsgLen/3);
+                HASH512_hash(&sha512,MD);
+            }
+            else if (!strcmp(argv[2], "sha384"))
+            {
+                HASH384_init(&sha384);
+                HASH384_process_array(&sha384,Msg,MsgLen/3);
+                HASH384_process_array(&sha384,Msg+MsgLen/3,MsgLen-MsgLen/3);
+                HASH384_hash(&sha384,MD);
+            }
+            else
+            {
+                HASH256_process_array(&sha256,Msg,MsgLen/3);
+                HASH256_process_array(&sha256,Msg+MsgLen/3,MsgLen-MsgLen/3);
+                HASH256_hash(&sha256,MD);
+            }
+
+            rc = OCT_comp(&MD1Oct,&MDOct);
+            if (!rc)
+            {
+                printf("TEST HASH FAILED COMPARE ARRAY MD LINE %d\n",lineNo);
+                exit(EXIT_FAILURE);
+            }
             free(Msg);
             Msg = NULL;
             free(MD1);